@@ -116,6 +116,30 @@ int pi();
 pid_t gettid(void);
 
 #include <stdio.h>
+#include <stdatomic.h>
+
+/*
+ * Soma com compensação de erro: 'sum' é o valor arredondado e 'error'
+ * acumula os bits perdidos nos arredondamentos (o valor exato é
+ * aproximadamente sum + error).
+ */
+typedef struct {
+   double sum;   // Valor da soma em ponto flutuante
+   double error; // Erro de arredondamento acumulado
+} CompensatedSum;
+
+/*
+ * Árvore binária de redução, com 'leaves' folhas. Os nós seguem o layout
+ * de heap: as folhas ocupam nodes[leaves .. 2*leaves - 1], o nó k combina
+ * os nós 2k e 2k + 1 e a raiz (resultado final) é nodes[1]. Cada nó interno
+ * é combinado pelo último dos seus dois filhos a chegar, de forma que a
+ * redução tem profundidade O(log P), sem mutex e sem espera entre threads.
+ */
+typedef struct {
+   int leaves;             // Número de folhas (participantes da redução)
+   CompensatedSum *nodes;  // Nós da árvore (2*leaves posições, a posição 0 não é usada)
+   atomic_int *arrivals;   // Chegadas em cada nó interno (leaves posições)
+} ReductionTree;
 
 /*
  * Contém os argumentos passados a cada thread pelos
@@ -123,8 +147,8 @@ pid_t gettid(void);
  */
 typedef struct {
    unsigned int first_term;   // Termo inicial da série 
-   double *pi_approximation;  // Acumulador do resultado dos termos da série, nos processos filho
-   pthread_mutex_t *pi_mutex; // Mutex binário para acessar 'pi_approximation'
+   int leaf;                  // Folha da árvore de redução ocupada pela thread
+   ReductionTree *reduction;  // Árvore de redução do resultado dos termos da série, nos processos filho
    Thread *thread_infos;      // Dados da Thread em questão
 } ThreadArgs; 
 
@@ -203,8 +227,8 @@ void performCalculation(ProcessReport *report, ProcessNumber process);
  * Cria 16 threads para aproximarem o Pi, esperando que
  * elas terminem, e retornando o valor do pi. São mandados
  * argumentos para as threads (ThreadArgs), de forma que elas
- * preencham informações importantes, como o TID e acumulem o
- * pi.
+ * preencham informações importantes, como o TID e reduzam o
+ * pi na árvore de redução.
  */
 double createPiThreads(Threads threads_infos);
 
@@ -230,6 +254,31 @@ TimeInfos *getTimeInfos(const Time *time);
  */
 void fillTimeReport(ProcessReport *report, const Time *start_time, const Time *end_time);
 
+/*
+ * Combina duas somas compensadas usando a transformação TwoSum de Knuth,
+ * preservando o erro de arredondamento da adição.
+ */
+CompensatedSum combineCompensatedSums(CompensatedSum a, CompensatedSum b);
+
+/*
+ * Inicializa a árvore de redução com 'leaves' folhas, usando os vetores
+ * 'nodes' (2*leaves posições) e 'arrivals' (leaves posições) fornecidos.
+ */
+void initReductionTree(ReductionTree *tree, CompensatedSum *nodes, atomic_int *arrivals, int leaves);
+
+/*
+ * Deposita o valor na folha 'leaf' e sobe a árvore combinando os nós em que
+ * o chamador é o último filho a chegar. Pode ser chamada concorrentemente,
+ * uma vez por folha.
+ */
+void reduceLeaf(ReductionTree *tree, int leaf, double value);
+
+/*
+ * Retorna o resultado da redução (raiz da árvore). Deve ser chamada apenas
+ * após todas as folhas terem sido reduzidas.
+ */
+double reductionResult(const ReductionTree *tree);
+
 /*
  * Cria os processos filhos, que por sua vez irão criar 16 threads e calcular
  * o número Pi, usando performCalculation(), e espera que os processos filhos
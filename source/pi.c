@@ -95,10 +95,8 @@ void* sumPartial(void *terms) {
     // Processa PARTIAL_NUMBER_OF_TERMS após thread_args->first_term.
     double pi_approximation = partialLeibnizFormula(thread_args->first_term);
 
-    // Obtém o lock do mutem para modificar o acumulador do pi.
-    pthread_mutex_lock(thread_args->pi_mutex);
-    *thread_args->pi_approximation += pi_approximation;
-    pthread_mutex_unlock(thread_args->pi_mutex);
+    // Deposita o resultado na árvore de redução, combinando os nós já completos.
+    reduceLeaf(thread_args->reduction, thread_args->leaf, pi_approximation);
     
     // Tempo após todo o processamento da thread.
     Time end_time;
@@ -334,18 +332,18 @@ double createPiThreads(Threads threads_infos) {
     // Os NUMBER_OF_THREADS argumentos das threads.
     ThreadArgs thread_args[NUMBER_OF_THREADS];
 
-    // O mutex binário para proteger "pi_approximation".
-    pthread_mutex_t pi_mutex;
-    pthread_mutex_init(&pi_mutex, NULL);
-
-    double pi_approximation = 0;
+    // A árvore de redução, com uma folha por thread.
+    CompensatedSum nodes[2*NUMBER_OF_THREADS];
+    atomic_int arrivals[NUMBER_OF_THREADS];
+    ReductionTree reduction;
+    initReductionTree(&reduction, nodes, arrivals, NUMBER_OF_THREADS);
 
     // Cria cada thread para operar a PARTIAL_NUMBER_OF_TERMS termos de distância uma da outra,
-    // acessando pi_approximation via o mutex, e preenchendo os argumentos.
+    // reduzindo o seu resultado na sua folha da árvore, e preenchendo os argumentos.
     for (int thread_num = 0; thread_num < NUMBER_OF_THREADS; thread_num++) {
         thread_args[thread_num].first_term = thread_num*PARTIAL_NUMBER_OF_TERMS;
-        thread_args[thread_num].pi_approximation = &pi_approximation;
-        thread_args[thread_num].pi_mutex = &pi_mutex;
+        thread_args[thread_num].leaf = thread_num;
+        thread_args[thread_num].reduction = &reduction;
         thread_args[thread_num].thread_infos = &threads_infos[thread_num];
         
         threads_infos[thread_num].threadID = createThread((unsigned int *) &thread_args[thread_num]);
@@ -356,7 +354,61 @@ double createPiThreads(Threads threads_infos) {
         pthread_join(threads_infos[thread_num].threadID, NULL);
     }
 
-    return 4*pi_approximation;
+    return 4*reductionResult(&reduction);
+}
+
+CompensatedSum combineCompensatedSums(CompensatedSum a, CompensatedSum b) {
+    // TwoSum: s é a soma arredondada e rounding_error o que foi perdido nela.
+    double s = a.sum + b.sum;
+    double b_virtual = s - a.sum;
+    double rounding_error = (a.sum - (s - b_virtual)) + (b.sum - b_virtual);
+
+    CompensatedSum result = {s, a.error + b.error + rounding_error};
+    return result;
+}
+
+void initReductionTree(ReductionTree *tree, CompensatedSum *nodes, atomic_int *arrivals, int leaves) {
+    if (!tree || !nodes || !arrivals || leaves < 1) {
+        return;
+    }
+
+    tree->leaves = leaves;
+    tree->nodes = nodes;
+    tree->arrivals = arrivals;
+
+    // Nenhum filho chegou ainda em nenhum nó interno.
+    for (int node = 0; node < leaves; node++) {
+        atomic_init(&arrivals[node], 0);
+    }
+}
+
+void reduceLeaf(ReductionTree *tree, int leaf, double value) {
+    if (!tree || leaf < 0 || leaf >= tree->leaves) {
+        return;
+    }
+
+    int node = tree->leaves + leaf;
+    tree->nodes[node].sum = value;
+    tree->nodes[node].error = 0.0;
+
+    // Sobe a árvore enquanto for o segundo filho a chegar; o primeiro a chegar
+    // termina, pois o irmão ainda irá combinar o nó pai. A semântica acq_rel
+    // garante a visibilidade do nó escrito pelo irmão.
+    while (node > 1) {
+        int parent = node/2;
+        if (atomic_fetch_add_explicit(&tree->arrivals[parent], 1, memory_order_acq_rel) == 0) {
+            return;
+        }
+        tree->nodes[parent] = combineCompensatedSums(tree->nodes[2*parent], tree->nodes[2*parent + 1]);
+        node = parent;
+    }
+}
+
+double reductionResult(const ReductionTree *tree) {
+    if (!tree) {
+        return 0.0;
+    }
+    return tree->nodes[1].sum + tree->nodes[1].error;
 }
 
 double timeDifference(const Time *start_time, const Time *end_time) {